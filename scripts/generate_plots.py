@@ -44,7 +44,8 @@ def plot_speedup():
             plt.scatter(data['Threads/Processes'], data['Speedup'], 
                        marker='s', label=impl, s=100)
 
-    plt.plot([1, 8], [1, 8], 'k--', label='Linear Speedup')
+    max_workers = max(parallel_df['Threads/Processes'].max(), 1)
+    plt.plot([1, max_workers], [1, max_workers], 'k--', label='Linear Speedup')
     plt.xlabel('Number of Threads/Processes')
     plt.ylabel('Speedup')
     plt.title('Speedup Analysis (N=1000)')
@@ -85,11 +86,15 @@ def plot_execution_time():
     
     for impl in ['Serial', 'OpenMP', 'MPI']:
         data = df[df['Implementation'] == impl]
-        if impl == 'OpenMP':
-            data = data[data['Threads/Processes'] == 8]  # Use 8 threads for OpenMP
+        label = impl
+        if impl == 'OpenMP' and not data.empty:
+            # Thread counts depend on the machine, so use the largest one measured
+            max_threads = data['Threads/Processes'].max()
+            data = data[data['Threads/Processes'] == max_threads]
+            label = f'{impl} ({max_threads} threads)'
         mean_times = data.groupby('Vertices')['Time(ms)'].mean()
         plt.plot(mean_times.index, mean_times.values, 
-                marker='o', label=f'{impl}')
+                marker='o', label=label)
 
     plt.yscale('log')
     plt.xscale('log')
@@ -0,0 +1,426 @@
+#include "autotune/auto_tuner.hpp"
+#include <omp.h>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#endif
+
+// Forward declarations of the engines
+Graph floydWarshall(Graph&& graph);
+Graph floydWarshallOpenMP(Graph&& graph, int numThreads);
+Graph floydWarshallBlocked(Graph&& graph, int numThreads, size_t tileSize);
+Graph allPairsDijkstra(Graph&& graph, int numThreads);
+
+namespace autotune {
+    namespace {
+        // Bounds on the calibration sub-block; the cap keeps a sweep to a few seconds
+        constexpr size_t MIN_CALIBRATION_VERTICES = 512;
+        constexpr size_t MAX_CALIBRATION_VERTICES = 1024;
+
+        // Candidates slower than this factor at the small size are not timed again
+        constexpr double CALIBRATION_PRUNE_FACTOR = 2.0;
+
+        // Upper edges of the density buckets used in profile keys
+        const std::vector<double> DENSITY_BUCKETS = {0.01, 0.02, 0.05, 0.1, 0.2, 0.4, 1.0};
+
+        int compiledSimdWidth() {
+#if defined(__AVX512F__)
+            return 16;
+#elif defined(__AVX2__) || defined(__AVX__)
+            return 8;
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+            return 4;
+#else
+            return 1;
+#endif
+        }
+
+#ifdef __APPLE__
+        size_t sysctlSize(const char* name) {
+            uint64_t value = 0;
+            size_t length = sizeof(value);
+            if (sysctlbyname(name, &value, &length, nullptr, 0) != 0) {
+                return 0;
+            }
+            return static_cast<size_t>(value);
+        }
+#else
+        // Parse sysfs cache sizes such as "48K" or "2048K"
+        size_t parseCacheSize(const std::string& text) {
+            size_t value = std::strtoull(text.c_str(), nullptr, 10);
+            if (text.find('K') != std::string::npos) {
+                value *= 1024;
+            } else if (text.find('M') != std::string::npos) {
+                value *= 1024 * 1024;
+            }
+            return value;
+        }
+
+        std::string readFirstLine(const std::filesystem::path& path) {
+            std::ifstream in(path);
+            std::string line;
+            std::getline(in, line);
+            return line;
+        }
+#endif
+
+        // Largest power-of-two tile whose three working tiles fit in the given cache
+        size_t tileForCache(size_t cacheBytes, int simdWidth) {
+            size_t tile = static_cast<size_t>(simdWidth);
+            while (3 * (2 * tile) * (2 * tile) * sizeof(int) <= cacheBytes) {
+                tile *= 2;
+            }
+            return tile;
+        }
+
+        // Leading n x n block of the input, so calibration sees the real weights and structure
+        Graph leadingBlock(const Graph& graph, size_t n) {
+            const auto& matrix = graph.getMatrix();
+            std::vector<std::vector<int>> block(n);
+            for (size_t i = 0; i < n; i++) {
+                block[i].assign(matrix[i].begin(), matrix[i].begin() + n);
+            }
+            return Graph(std::move(block));
+        }
+
+        double timeChoice(const Graph& sample, const TuningChoice& choice) {
+            Graph input = sample;
+            auto start = std::chrono::high_resolution_clock::now();
+            Graph result = runChoice(std::move(input), choice);
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+    }
+
+    std::string HardwareInfo::signature() const {
+        std::ostringstream out;
+        out << "c" << cores
+            << "-l1_" << l1Bytes / 1024 << "K"
+            << "-l2_" << l2Bytes / 1024 << "K"
+            << "-l3_" << l3Bytes / 1024 << "K"
+            << "-numa" << numaNodes
+            << "-simd" << simdWidth;
+        return out.str();
+    }
+
+    const char* engineName(Engine engine) {
+        switch (engine) {
+            case Engine::Serial: return "serial";
+            case Engine::OpenMP: return "openmp";
+            case Engine::Blocked: return "blocked";
+            case Engine::Sparse: return "sparse";
+        }
+        return "unknown";
+    }
+
+    Engine parseEngine(const std::string& name) {
+        if (name == "serial") return Engine::Serial;
+        if (name == "openmp") return Engine::OpenMP;
+        if (name == "blocked") return Engine::Blocked;
+        if (name == "sparse") return Engine::Sparse;
+        throw std::invalid_argument("Unknown engine: " + name);
+    }
+
+    HardwareInfo detectHardware() {
+        // Conservative defaults for platforms we cannot query
+        HardwareInfo info = {omp_get_num_procs(), 32 * 1024, 256 * 1024, 0, 1, compiledSimdWidth()};
+
+#ifdef __APPLE__
+        if (size_t l1 = sysctlSize("hw.l1dcachesize")) info.l1Bytes = l1;
+        if (size_t l2 = sysctlSize("hw.l2cachesize")) info.l2Bytes = l2;
+        info.l3Bytes = sysctlSize("hw.l3cachesize");
+#else
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        const fs::path cacheDir("/sys/devices/system/cpu/cpu0/cache");
+        for (const auto& entry : fs::directory_iterator(cacheDir, ec)) {
+            if (entry.path().filename().string().rfind("index", 0) != 0) {
+                continue;
+            }
+            const std::string type = readFirstLine(entry.path() / "type");
+            if (type == "Instruction") {
+                continue;
+            }
+            const int level = std::atoi(readFirstLine(entry.path() / "level").c_str());
+            const size_t bytes = parseCacheSize(readFirstLine(entry.path() / "size"));
+            if (bytes == 0) {
+                continue;
+            }
+            if (level == 1) info.l1Bytes = bytes;
+            else if (level == 2) info.l2Bytes = bytes;
+            else if (level == 3) info.l3Bytes = bytes;
+        }
+
+        int nodes = 0;
+        for (const auto& entry : fs::directory_iterator("/sys/devices/system/node", ec)) {
+            const std::string name = entry.path().filename().string();
+            if (name.size() > 4 && name.rfind("node", 0) == 0 &&
+                std::isdigit(static_cast<unsigned char>(name[4]))) {
+                nodes++;
+            }
+        }
+        if (nodes > 0) {
+            info.numaNodes = nodes;
+        }
+#endif
+
+        return info;
+    }
+
+    GraphStats measureGraph(const Graph& graph) {
+        const size_t V = graph.size();
+        const auto& matrix = graph.getMatrix();
+        size_t edges = 0;
+        bool negative = false;
+
+        for (size_t i = 0; i < V; i++) {
+            for (size_t j = 0; j < V; j++) {
+                if (i != j && matrix[i][j] != Graph::INF) {
+                    edges++;
+                    negative = negative || matrix[i][j] < 0;
+                }
+            }
+        }
+
+        const double density = (V > 1) ? static_cast<double>(edges) / (V * (V - 1)) : 0.0;
+        return {V, density, negative};
+    }
+
+    std::string defaultProfilePath() {
+        const char* path = std::getenv("FW_TUNING_PROFILE");
+        return (path && *path) ? path : "fw_tuning_profile.txt";
+    }
+
+    TuningProfile::TuningProfile(std::string path) : path(std::move(path)) {}
+
+    void TuningProfile::load() {
+        entries.clear();
+        std::ifstream in(path);
+        std::string line;
+
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string key, engine;
+            TuningChoice choice{};
+            std::string extra;
+            if (fields >> key >> engine >> choice.threads >> choice.tileSize >> choice.timeMs &&
+                !(fields >> extra)) { // Lines with extra fields come from an older format
+                try {
+                    choice.engine = parseEngine(engine);
+                    entries[key] = choice;
+                } catch (const std::invalid_argument&) {
+                    // Skip entries written by a newer version with unknown engines
+                }
+            }
+        }
+    }
+
+    void TuningProfile::save() const {
+        // Write to a temporary file first so a concurrent reader never sees a partial
+        // profile; the pid keeps concurrent writers from sharing the temporary file
+        const std::string tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+        {
+            std::ofstream out(tmpPath);
+            if (!out) {
+                throw std::runtime_error("Cannot write tuning profile: " + tmpPath);
+            }
+            out << "# key engine threads tile predicted_ms\n";
+            for (const auto& [key, choice] : entries) {
+                out << key << " " << engineName(choice.engine) << " " << choice.threads << " "
+                    << choice.tileSize << " " << choice.timeMs << "\n";
+            }
+            out.close();
+            if (!out) {
+                std::error_code ec;
+                std::filesystem::remove(tmpPath, ec);
+                throw std::runtime_error("Cannot write tuning profile: " + tmpPath);
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmpPath, ec);
+            throw std::runtime_error("Cannot write tuning profile: " + path);
+        }
+    }
+
+    bool TuningProfile::lookup(const std::string& key, TuningChoice& choice) const {
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            return false;
+        }
+        choice = it->second;
+        return true;
+    }
+
+    void TuningProfile::store(const std::string& key, const TuningChoice& choice) {
+        entries[key] = choice;
+    }
+
+    std::string TuningProfile::key(const HardwareInfo& hardware, const GraphStats& stats) {
+        const int sizeBucket = static_cast<int>(std::log2(static_cast<double>(std::max<size_t>(stats.vertices, 1))));
+        const size_t densityBucket = std::lower_bound(DENSITY_BUCKETS.begin(), DENSITY_BUCKETS.end(),
+                                                      stats.density) - DENSITY_BUCKETS.begin();
+
+        std::ostringstream out;
+        out << hardware.signature()
+            << "|v" << sizeBucket
+            << "|d" << densityBucket
+            << (stats.hasNegativeWeights ? "|neg" : "|pos");
+        return out.str();
+    }
+
+    std::vector<TuningChoice> candidateChoices(const HardwareInfo& hardware, const GraphStats& stats) {
+        std::vector<TuningChoice> candidates;
+        const int simd = hardware.simdWidth;
+        const int cores = std::max(hardware.cores, 1);
+
+        candidates.push_back({Engine::Serial, 1, 0, 0.0});
+
+        std::vector<int> threadCounts;
+        for (int t = 2; t < cores; t *= 2) {
+            threadCounts.push_back(t);
+        }
+        if (cores > 1) {
+            threadCounts.push_back(cores);
+        }
+        for (int threads : threadCounts) {
+            candidates.push_back({Engine::OpenMP, threads, 0, 0.0});
+        }
+
+        // Tiles sized for L1 and L2, plus one in between
+        const size_t l1Tile = tileForCache(hardware.l1Bytes, simd);
+        const size_t l2Tile = tileForCache(hardware.l2Bytes, simd);
+        std::vector<size_t> tiles = {l1Tile, std::max(l1Tile, l2Tile / 2), l2Tile};
+        tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+        // Filtered against the full graph, not the calibration sub-block
+        for (size_t tile : tiles) {
+            if (tile < stats.vertices) {
+                candidates.push_back({Engine::Blocked, cores, tile, 0.0});
+            }
+        }
+
+        if (!stats.hasNegativeWeights) {
+            candidates.push_back({Engine::Sparse, cores, 0, 0.0});
+        }
+
+        return candidates;
+    }
+
+    size_t calibrationVertices(const HardwareInfo& hardware, size_t vertices) {
+        const size_t largestTile = tileForCache(hardware.l2Bytes, hardware.simdWidth);
+        size_t n = std::max(MIN_CALIBRATION_VERTICES, 2 * largestTile);
+        while (n < MAX_CALIBRATION_VERTICES && n * n * sizeof(int) < 2 * hardware.l2Bytes) {
+            n *= 2;
+        }
+        return std::min({n, MAX_CALIBRATION_VERTICES, vertices});
+    }
+
+    TuningChoice calibrate(const Graph& graph, const HardwareInfo& hardware, const GraphStats& stats) {
+        std::vector<TuningChoice> candidates = candidateChoices(hardware, stats);
+        const size_t V = stats.vertices;
+        const size_t large = calibrationVertices(hardware, V);
+
+        // Small inputs are timed directly at full size
+        if (large == V) {
+            TuningChoice best = candidates.front();
+            best.timeMs = timeChoice(graph, best);
+            for (size_t c = 1; c < candidates.size(); c++) {
+                TuningChoice choice = candidates[c];
+                choice.timeMs = timeChoice(graph, choice);
+                if (choice.timeMs < best.timeMs) {
+                    best = choice;
+                }
+            }
+            return best;
+        }
+
+        const size_t small = large / 2;
+        const Graph smallBlock = leadingBlock(graph, small);
+        std::vector<double> smallTimes(candidates.size());
+        for (size_t c = 0; c < candidates.size(); c++) {
+            smallTimes[c] = timeChoice(smallBlock, candidates[c]);
+        }
+        const double bestSmall = *std::min_element(smallTimes.begin(), smallTimes.end());
+
+        const Graph largeBlock = leadingBlock(graph, large);
+        TuningChoice best = candidates.front();
+        best.timeMs = std::numeric_limits<double>::max();
+
+        for (size_t c = 0; c < candidates.size(); c++) {
+            TuningChoice choice = candidates[c];
+            if (smallTimes[c] > CALIBRATION_PRUNE_FACTOR * bestSmall) {
+                // Clear loser: extrapolate cubically instead of spending time on it
+                choice.timeMs = smallTimes[c] * std::pow(static_cast<double>(V) / small, 3.0);
+            } else {
+                // Fit t ~ n^p between the two sizes; the clamp absorbs timer noise
+                const double largeTime = timeChoice(largeBlock, choice);
+                const double ratio = largeTime / std::max(smallTimes[c], 1e-3);
+                const double exponent = std::clamp(std::log2(ratio), 2.0, 4.0);
+                choice.timeMs = largeTime * std::pow(static_cast<double>(V) / large, exponent);
+            }
+            if (choice.timeMs < best.timeMs) {
+                best = choice;
+            }
+        }
+
+        return best;
+    }
+
+    TuningChoice selectEngine(const Graph& graph, TuningProfile& profile) {
+        const HardwareInfo hardware = detectHardware();
+        const GraphStats stats = measureGraph(graph);
+        const std::string key = TuningProfile::key(hardware, stats);
+
+        TuningChoice choice;
+        if (!profile.lookup(key, choice)) {
+            choice = calibrate(graph, hardware, stats);
+            profile.store(key, choice);
+            // The calibrated choice is still valid if it cannot be persisted,
+            // e.g. from a read-only working directory under a batch scheduler
+            try {
+                profile.save();
+            } catch (const std::exception& e) {
+                std::cerr << "Warning: " << e.what() << "; continuing without saving" << std::endl;
+            }
+        }
+        return choice;
+    }
+
+    Graph runChoice(Graph&& graph, const TuningChoice& choice) {
+        switch (choice.engine) {
+            case Engine::Serial:
+                return floydWarshall(std::move(graph));
+            case Engine::OpenMP:
+                return floydWarshallOpenMP(std::move(graph), choice.threads);
+            case Engine::Blocked:
+                return floydWarshallBlocked(std::move(graph), choice.threads, choice.tileSize);
+            case Engine::Sparse:
+                return allPairsDijkstra(std::move(graph), choice.threads);
+        }
+        throw std::invalid_argument("Unknown engine");
+    }
+
+    Graph solveShortestPaths(Graph&& graph, const std::string& profilePath) {
+        TuningProfile profile(profilePath);
+        profile.load();
+        const TuningChoice choice = selectEngine(graph, profile);
+        return runChoice(std::move(graph), choice);
+    }
+}
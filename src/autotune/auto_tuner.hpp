@@ -0,0 +1,86 @@
+#pragma once
+#include "common/graph.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autotune {
+    // Shortest-path engines the tuner can dispatch to
+    enum class Engine { Serial, OpenMP, Blocked, Sparse };
+
+    // Machine properties that drive the candidate configurations
+    struct HardwareInfo {
+        int cores;
+        size_t l1Bytes;
+        size_t l2Bytes;
+        size_t l3Bytes;
+        int numaNodes;
+        int simdWidth; // ints per vector register for the compiled target (see FW_NATIVE_ARCH)
+
+        // Compact identifier used to key persisted profiles
+        std::string signature() const;
+    };
+
+    // Properties of the input graph that affect which engine wins
+    struct GraphStats {
+        size_t vertices;
+        double density;
+        bool hasNegativeWeights;
+    };
+
+    // One engine configuration and its run time predicted from calibration
+    struct TuningChoice {
+        Engine engine;
+        int threads;
+        size_t tileSize;
+        double timeMs;
+    };
+
+    const char* engineName(Engine engine);
+    Engine parseEngine(const std::string& name);
+
+    HardwareInfo detectHardware();
+    GraphStats measureGraph(const Graph& graph);
+
+    // Profile path from FW_TUNING_PROFILE, or a file in the working directory
+    std::string defaultProfilePath();
+
+    // Calibration results persisted as one line per (hardware, size, density) bucket
+    class TuningProfile {
+    public:
+        explicit TuningProfile(std::string path);
+
+        // Read the profile file; a missing file yields an empty profile
+        void load();
+        // Replace the file atomically; throws std::runtime_error if it cannot be written
+        void save() const;
+
+        bool lookup(const std::string& key, TuningChoice& choice) const;
+        void store(const std::string& key, const TuningChoice& choice);
+
+        static std::string key(const HardwareInfo& hardware, const GraphStats& stats);
+
+    private:
+        std::string path;
+        std::map<std::string, TuningChoice> entries;
+    };
+
+    // Configurations worth timing for the given hardware and graph
+    std::vector<TuningChoice> candidateChoices(const HardwareInfo& hardware, const GraphStats& stats);
+
+    // Largest sub-block of the input timed during calibration: big enough to
+    // spill L2 and hold two of the largest tiles, small enough to stay short
+    size_t calibrationVertices(const HardwareInfo& hardware, size_t vertices);
+
+    // Time the candidates on leading sub-blocks of the input at two sizes, fit each
+    // one's growth exponent and return the one predicted fastest at full size
+    TuningChoice calibrate(const Graph& graph, const HardwareInfo& hardware, const GraphStats& stats);
+
+    // Reuse the profiled choice for this graph, calibrating and persisting it on a miss
+    TuningChoice selectEngine(const Graph& graph, TuningProfile& profile);
+
+    Graph runChoice(Graph&& graph, const TuningChoice& choice);
+
+    // Single entry point: pick the engine for this graph and run it
+    Graph solveShortestPaths(Graph&& graph, const std::string& profilePath = defaultProfilePath());
+}
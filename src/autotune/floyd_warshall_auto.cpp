@@ -0,0 +1,52 @@
+#include "autotune/auto_tuner.hpp"
+#include <chrono>
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    try {
+        size_t V = (argc > 1) ? std::stoul(argv[1]) : 5;
+        double density = (argc > 2) ? std::stod(argv[2]) : 0.3;
+        std::string profilePath = (argc > 3) ? argv[3] : autotune::defaultProfilePath();
+
+        const autotune::HardwareInfo hardware = autotune::detectHardware();
+        std::cout << "Running auto-tuned shortest paths" << std::endl;
+        std::cout << "Vertices: " << V << std::endl;
+        std::cout << "Hardware: " << hardware.signature() << std::endl;
+        std::cout << "Profile: " << profilePath << std::endl;
+
+        Graph graph = Graph::generateRandom(V, density);
+
+        std::cout << "\nOriginal graph:" << std::endl;
+        graph.print();
+
+        autotune::TuningProfile profile(profilePath);
+        profile.load();
+
+        auto tuneStart = std::chrono::high_resolution_clock::now();
+        const autotune::TuningChoice choice = autotune::selectEngine(graph, profile);
+        auto tuneEnd = std::chrono::high_resolution_clock::now();
+
+        std::cout << "\nSelected engine: " << autotune::engineName(choice.engine)
+                  << ", Threads: " << choice.threads
+                  << ", Tile: " << choice.tileSize << std::endl;
+        std::cout << "Selection time: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(tuneEnd - tuneStart).count()
+                  << " ms" << std::endl;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        Graph result = autotune::runChoice(std::move(graph), choice);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        std::cout << "\nShortest paths:" << std::endl;
+        result.print();
+        std::cout << "\nExecution time: " << duration.count() << " ms" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
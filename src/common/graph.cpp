@@ -12,6 +12,25 @@ Graph::Graph(size_t vertices) : numVertices(vertices) {
     }
 }
 
+Graph::Graph(std::vector<std::vector<int>>&& matrix) : numVertices(matrix.size()) {
+    if (matrix.empty()) {
+        throw std::invalid_argument("Graph must have at least one vertex");
+    }
+    for (const auto& row : matrix) {
+        if (row.size() != numVertices) {
+            throw std::invalid_argument("Adjacency matrix must be square");
+        }
+    }
+    adjacencyMatrix = std::move(matrix);
+}
+
+std::vector<std::vector<int>> Graph::releaseMatrix() {
+    std::vector<std::vector<int>> matrix = std::move(adjacencyMatrix);
+    adjacencyMatrix.clear();
+    numVertices = 0;
+    return matrix;
+}
+
 void Graph::setEdge(size_t src, size_t dest, int weight) {
     if (src >= numVertices || dest >= numVertices) {
         throw std::out_of_range("Vertex index out of range");
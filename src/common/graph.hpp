@@ -9,6 +9,9 @@ public:
     // Constructor for creating a graph with n vertices
     explicit Graph(size_t vertices);
 
+    // Constructor that takes ownership of an existing square matrix without copying
+    explicit Graph(std::vector<std::vector<int>>&& matrix);
+
     // Add weighted edge from source to destination
     void setEdge(size_t src, size_t dest, int weight);
 
@@ -29,6 +32,9 @@ public:
     std::vector<std::vector<int>>& getMatrix() { return adjacencyMatrix; }
     const std::vector<std::vector<int>>& getMatrix() const { return adjacencyMatrix; }
 
+    // Move the underlying matrix out to the caller, leaving the graph empty
+    std::vector<std::vector<int>> releaseMatrix();
+
     // Constants for graph representation
     static constexpr int INF = std::numeric_limits<int>::max() / 2; // Prevent overflow in addition
 
@@ -0,0 +1,75 @@
+#include "reachability_matrix.hpp"
+#include <random>
+
+ReachabilityMatrix::ReachabilityMatrix(size_t vertices) : numVertices(vertices) {
+    if (vertices == 0) {
+        throw std::invalid_argument("Graph must have at least one vertex");
+    }
+    const size_t words = (vertices + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    rowWords = (words + ROW_ALIGN_WORDS - 1) / ROW_ALIGN_WORDS * ROW_ALIGN_WORDS;
+    bits.assign(vertices * rowWords, 0);
+    for (size_t i = 0; i < vertices; ++i) {
+        row(i)[i / BITS_PER_WORD] |= uint64_t{1} << (i % BITS_PER_WORD);
+    }
+}
+
+void ReachabilityMatrix::setEdge(size_t src, size_t dest) {
+    if (src >= numVertices || dest >= numVertices) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+    row(src)[dest / BITS_PER_WORD] |= uint64_t{1} << (dest % BITS_PER_WORD);
+}
+
+bool ReachabilityMatrix::getEdge(size_t src, size_t dest) const {
+    if (src >= numVertices || dest >= numVertices) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+    return (row(src)[dest / BITS_PER_WORD] >> (dest % BITS_PER_WORD)) & 1;
+}
+
+void ReachabilityMatrix::print() const {
+    std::cout << "Reachability Matrix:" << std::endl;
+    for (size_t i = 0; i < numVertices; ++i) {
+        for (size_t j = 0; j < numVertices; ++j) {
+            std::cout << (getEdge(i, j) ? " 1" : " 0");
+        }
+        std::cout << std::endl;
+    }
+}
+
+ReachabilityMatrix ReachabilityMatrix::fromGraph(const Graph& graph) {
+    const size_t V = graph.size();
+    const auto& matrix = graph.getMatrix();
+    ReachabilityMatrix result(V);
+
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = 0; j < V; ++j) {
+            if (matrix[i][j] != Graph::INF) {
+                result.setEdge(i, j);
+            }
+        }
+    }
+
+    return result;
+}
+
+ReachabilityMatrix ReachabilityMatrix::generateRandom(size_t vertices, double density) {
+    if (density < 0.0 || density > 1.0) {
+        throw std::invalid_argument("Density must be between 0 and 1");
+    }
+
+    ReachabilityMatrix matrix(vertices);
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> disDensity(0.0, 1.0);
+
+    for (size_t i = 0; i < vertices; ++i) {
+        for (size_t j = 0; j < vertices; ++j) {
+            if (i != j && disDensity(gen) < density) {
+                matrix.setEdge(i, j);
+            }
+        }
+    }
+
+    return matrix;
+}
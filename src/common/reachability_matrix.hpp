@@ -0,0 +1,50 @@
+#pragma once
+#include "graph.hpp"
+#include <cstdint>
+#include <vector>
+
+// Boolean adjacency/reachability matrix packed 64 vertices per word. Rows are
+// padded to a multiple of four words so whole rows can be OR-ed with 256-bit
+// vector operations. Every vertex reaches itself, matching the zero diagonal of Graph.
+class ReachabilityMatrix {
+public:
+    // Constructor for creating a matrix with n vertices and no edges
+    explicit ReachabilityMatrix(size_t vertices);
+
+    // Mark dest as directly reachable from src
+    void setEdge(size_t src, size_t dest);
+
+    // Check whether dest is reachable from src
+    bool getEdge(size_t src, size_t dest) const;
+
+    // Get number of vertices
+    size_t size() const { return numVertices; }
+
+    // Number of 64-bit words per (padded) row
+    size_t wordsPerRow() const { return rowWords; }
+
+    // Print the matrix as 0/1 entries
+    void print() const;
+
+    // Build from a weighted graph: an edge exists wherever the weight is finite
+    static ReachabilityMatrix fromGraph(const Graph& graph);
+
+    // Create a random directed graph with given number of vertices and density
+    static ReachabilityMatrix generateRandom(size_t vertices, double density = 0.3);
+
+    // Get row i for direct manipulation in algorithms
+    uint64_t* row(size_t i) { return bits.data() + i * rowWords; }
+    const uint64_t* row(size_t i) const { return bits.data() + i * rowWords; }
+
+    // Get the packed rows for direct manipulation in algorithms
+    std::vector<uint64_t>& getData() { return bits; }
+    const std::vector<uint64_t>& getData() const { return bits; }
+
+    static constexpr size_t BITS_PER_WORD = 64;
+    static constexpr size_t ROW_ALIGN_WORDS = 4;
+
+private:
+    std::vector<uint64_t> bits;
+    size_t numVertices;
+    size_t rowWords;
+};
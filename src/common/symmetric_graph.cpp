@@ -0,0 +1,102 @@
+#include "symmetric_graph.hpp"
+#include <random>
+#include <iomanip>
+#include <utility>
+
+SymmetricGraph::SymmetricGraph(size_t vertices) : numVertices(vertices) {
+    if (vertices == 0) {
+        throw std::invalid_argument("Graph must have at least one vertex");
+    }
+    packedData.resize(vertices * (vertices + 1) / 2, INF);
+    for (size_t i = 0; i < vertices; ++i) {
+        packedData[index(i, i)] = 0;
+    }
+}
+
+void SymmetricGraph::setEdge(size_t src, size_t dest, int weight) {
+    if (src >= numVertices || dest >= numVertices) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+    if (src > dest) {
+        std::swap(src, dest);
+    }
+    packedData[index(src, dest)] = weight;
+}
+
+int SymmetricGraph::getEdge(size_t src, size_t dest) const {
+    if (src >= numVertices || dest >= numVertices) {
+        throw std::out_of_range("Vertex index out of range");
+    }
+    if (src > dest) {
+        std::swap(src, dest);
+    }
+    return packedData[index(src, dest)];
+}
+
+void SymmetricGraph::print() const {
+    std::cout << "Distance Matrix:" << std::endl;
+    for (size_t i = 0; i < numVertices; ++i) {
+        for (size_t j = 0; j < numVertices; ++j) {
+            int value = getEdge(i, j);
+            if (value == INF) {
+                std::cout << std::setw(5) << "INF";
+            } else {
+                std::cout << std::setw(5) << value;
+            }
+        }
+        std::cout << std::endl;
+    }
+}
+
+SymmetricGraph SymmetricGraph::generateRandom(size_t vertices, double density, int minWeight, int maxWeight) {
+    if (density < 0.0 || density > 1.0) {
+        throw std::invalid_argument("Density must be between 0 and 1");
+    }
+
+    SymmetricGraph graph(vertices);
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> disDensity(0.0, 1.0);
+    std::uniform_int_distribution<> disWeight(minWeight, maxWeight);
+
+    for (size_t i = 0; i < vertices; ++i) {
+        for (size_t j = i + 1; j < vertices; ++j) {
+            if (disDensity(gen) < density) {
+                graph.setEdge(i, j, disWeight(gen));
+            }
+        }
+    }
+
+    return graph;
+}
+
+SymmetricGraph SymmetricGraph::fromGraph(const Graph& graph) {
+    const size_t V = graph.size();
+    const auto& matrix = graph.getMatrix();
+    SymmetricGraph result(V);
+
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = i; j < V; ++j) {
+            if (matrix[i][j] != matrix[j][i]) {
+                throw std::invalid_argument("Graph is not symmetric");
+            }
+            result.packedData[result.index(i, j)] = matrix[i][j];
+        }
+    }
+
+    return result;
+}
+
+Graph SymmetricGraph::toGraph() const {
+    Graph graph(numVertices);
+    auto& matrix = graph.getMatrix();
+
+    for (size_t i = 0; i < numVertices; ++i) {
+        for (size_t j = i; j < numVertices; ++j) {
+            matrix[i][j] = packedData[index(i, j)];
+            matrix[j][i] = packedData[index(i, j)];
+        }
+    }
+
+    return graph;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "graph.hpp"
+#include <vector>
+
+// Undirected graph stored as the packed upper triangle (i <= j) of the distance
+// matrix, row by row, so it needs V(V+1)/2 entries instead of V².
+class SymmetricGraph {
+public:
+    // Constructor for creating a graph with n vertices
+    explicit SymmetricGraph(size_t vertices);
+
+    // Add undirected weighted edge; both directions read back the same weight
+    void setEdge(size_t src, size_t dest, int weight);
+
+    // Get weight of edge between the two vertices
+    int getEdge(size_t src, size_t dest) const;
+
+    // Get number of vertices
+    size_t size() const { return numVertices; }
+
+    // Print the full (mirrored) distance matrix
+    void print() const;
+
+    // Create a random undirected graph with given number of vertices and density
+    static SymmetricGraph generateRandom(size_t vertices, double density = 0.3,
+                                         int minWeight = 1, int maxWeight = 100);
+
+    // Convert from a dense graph; throws if the matrix is not symmetric
+    static SymmetricGraph fromGraph(const Graph& graph);
+
+    // Expand into a dense graph
+    Graph toGraph() const;
+
+    // Offset of row i in the packed data; row i holds columns i..V-1
+    size_t rowOffset(size_t i) const { return i * (2 * numVertices - i + 1) / 2; }
+
+    // Packed index of (i, j) for i <= j
+    size_t index(size_t i, size_t j) const { return rowOffset(i) + (j - i); }
+
+    // Get the packed triangle for direct manipulation in algorithms
+    std::vector<int>& getData() { return packedData; }
+    const std::vector<int>& getData() const { return packedData; }
+
+    static constexpr int INF = Graph::INF;
+
+private:
+    std::vector<int> packedData;
+    size_t numVertices;
+};
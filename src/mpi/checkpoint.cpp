@@ -0,0 +1,221 @@
+#include "mpi/checkpoint.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <unistd.h>
+
+namespace checkpoint {
+    namespace {
+        constexpr uint64_t PARTITION_MAGIC = 0x4657434b50543032ULL; // "FWCKPT02"
+
+        struct PartitionHeader {
+            uint64_t magic;
+            uint64_t vertices;
+            uint64_t size;
+            uint64_t rank;
+            uint64_t startRow;
+            uint64_t numRows;
+            uint64_t nextK;
+            uint64_t inputHash;
+        };
+
+        // Write data to path via a temporary file, fsync it and rename it into place,
+        // so a crash never leaves a truncated file under the final name
+        void writeFileAtomically(const std::string& path, const void* header, size_t headerBytes,
+                                 const void* data, size_t dataBytes) {
+            const std::string tmpPath = path + ".tmp";
+            std::FILE* file = std::fopen(tmpPath.c_str(), "wb");
+            if (!file) {
+                throw std::runtime_error("Cannot open checkpoint file: " + tmpPath);
+            }
+
+            bool ok = std::fwrite(header, 1, headerBytes, file) == headerBytes &&
+                      (dataBytes == 0 || std::fwrite(data, 1, dataBytes, file) == dataBytes) &&
+                      std::fflush(file) == 0 &&
+                      fsync(fileno(file)) == 0;
+            ok = (std::fclose(file) == 0) && ok;
+            if (!ok) {
+                std::remove(tmpPath.c_str());
+                throw std::runtime_error("Cannot write checkpoint file: " + tmpPath);
+            }
+
+            std::filesystem::rename(tmpPath, path);
+        }
+
+        // Round of a file named rank<rank>.k<k>.ckpt[.tmp]; false for other files
+        bool parsePartitionName(const std::string& name, int rank, size_t& k, bool& temporary) {
+            const std::string prefix = "rank" + std::to_string(rank) + ".k";
+            const std::string suffix = ".ckpt";
+            if (name.compare(0, prefix.size(), prefix) != 0) {
+                return false;
+            }
+            const size_t digitsEnd = name.find_first_not_of("0123456789", prefix.size());
+            if (digitsEnd == prefix.size() || digitsEnd == std::string::npos ||
+                name.compare(digitsEnd, suffix.size(), suffix) != 0) {
+                return false;
+            }
+            const std::string rest = name.substr(digitsEnd + suffix.size());
+            if (!rest.empty() && rest != ".tmp") {
+                return false;
+            }
+            k = std::stoull(name.substr(prefix.size(), digitsEnd - prefix.size()));
+            temporary = !rest.empty();
+            return true;
+        }
+
+        // Whether the header describes this rank's partition for round k, ignoring the input hash
+        bool headerMatches(const PartitionHeader& header, int rank, int size, size_t vertices,
+                           size_t startRow, size_t numRows, size_t k) {
+            return header.magic == PARTITION_MAGIC && header.vertices == vertices &&
+                   header.size == static_cast<uint64_t>(size) && header.rank == static_cast<uint64_t>(rank) &&
+                   header.startRow == startRow && header.numRows == numRows && header.nextK == k;
+        }
+    }
+
+    std::string partitionPath(const std::string& directory, int rank, size_t k) {
+        return directory + "/rank" + std::to_string(rank) + ".k" + std::to_string(k) + ".ckpt";
+    }
+
+    PartitionWriter::PartitionWriter(std::string directory, int rank, int size, size_t vertices,
+                                     size_t startRow, size_t numRows, uint64_t inputHash, size_t resumeK)
+        : directory(std::move(directory)), rank(rank), size(size), vertices(vertices),
+          startRow(startRow), numRows(numRows), inputHash(inputHash) {
+        std::filesystem::create_directories(this->directory);
+        staging.resize(numRows * vertices);
+
+        for (const auto& entry : std::filesystem::directory_iterator(this->directory)) {
+            size_t k = 0;
+            bool temporary = false;
+            if (parsePartitionName(entry.path().filename().string(), rank, k, temporary) &&
+                (temporary || k != resumeK)) {
+                std::error_code ec;
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+        if (resumeK > 0) {
+            writtenRounds.push_back(resumeK);
+            completedK = resumeK;
+        }
+    }
+
+    PartitionWriter::~PartitionWriter() {
+        wait();
+    }
+
+    void PartitionWriter::start(size_t nextK, const std::vector<std::vector<int>>& dist) {
+        wait(); // The staging buffer is reused, so the previous write must be done
+
+        for (size_t r = 0; r < numRows; r++) {
+            std::copy(dist[startRow + r].begin(), dist[startRow + r].end(),
+                      staging.begin() + r * vertices);
+        }
+
+        worker = std::thread([this, nextK]() {
+            const PartitionHeader header = {PARTITION_MAGIC, vertices, static_cast<uint64_t>(size),
+                                            static_cast<uint64_t>(rank), startRow, numRows, nextK,
+                                            inputHash};
+            try {
+                writeFileAtomically(partitionPath(directory, rank, nextK), &header, sizeof(header),
+                                    staging.data(), staging.size() * sizeof(int));
+                writtenRounds.push_back(nextK);
+                completedK = nextK;
+            } catch (const std::exception& e) {
+                // A failed checkpoint must not kill the run; the previous one stays valid
+                std::cerr << "Process " << rank << " checkpoint failed: " << e.what() << std::endl;
+            }
+        });
+    }
+
+    void PartitionWriter::wait() {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    void PartitionWriter::pruneBefore(size_t k) {
+        wait(); // writtenRounds is updated by the worker
+        std::vector<size_t> kept;
+        for (size_t written : writtenRounds) {
+            if (written < k) {
+                std::error_code ec;
+                std::filesystem::remove(partitionPath(directory, rank, written), ec);
+            } else {
+                kept.push_back(written);
+            }
+        }
+        writtenRounds.swap(kept);
+    }
+
+    uint64_t hashRows(const std::vector<std::vector<int>>& dist, size_t startRow, size_t numRows) {
+        // FNV-1a over the rows' bytes
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (size_t r = startRow; r < startRow + numRows; r++) {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(dist[r].data());
+            for (size_t b = 0; b < dist[r].size() * sizeof(int); b++) {
+                hash = (hash ^ bytes[b]) * 0x100000001b3ULL;
+            }
+        }
+        return hash;
+    }
+
+    std::vector<size_t> availableRounds(const std::string& directory, int rank, int size,
+                                        size_t vertices, size_t startRow, size_t numRows,
+                                        uint64_t inputHash, bool& otherInput) {
+        otherInput = false;
+        std::vector<size_t> rounds;
+        std::error_code ec;
+        std::filesystem::directory_iterator it(directory, ec);
+        if (ec) {
+            return rounds;
+        }
+
+        const uintmax_t expectedBytes = sizeof(PartitionHeader) + numRows * vertices * sizeof(int);
+        for (const auto& entry : it) {
+            size_t k = 0;
+            bool temporary = false;
+            if (!parsePartitionName(entry.path().filename().string(), rank, k, temporary) || temporary ||
+                std::filesystem::file_size(entry.path(), ec) != expectedBytes || ec) {
+                continue;
+            }
+            std::ifstream in(entry.path(), std::ios::binary);
+            PartitionHeader header{};
+            if (in.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                headerMatches(header, rank, size, vertices, startRow, numRows, k)) {
+                if (header.inputHash == inputHash) {
+                    rounds.push_back(k);
+                } else {
+                    otherInput = true;
+                }
+            }
+        }
+
+        std::sort(rounds.rbegin(), rounds.rend());
+        return rounds;
+    }
+
+    bool readPartition(const std::string& directory, int rank, int size, size_t vertices,
+                       size_t startRow, size_t numRows, uint64_t inputHash, size_t k,
+                       std::vector<std::vector<int>>& dist) {
+        std::ifstream in(partitionPath(directory, rank, k), std::ios::binary);
+        PartitionHeader header{};
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            return false;
+        }
+        if (!headerMatches(header, rank, size, vertices, startRow, numRows, k) ||
+            header.inputHash != inputHash) {
+            return false;
+        }
+
+        for (size_t r = 0; r < numRows; r++) {
+            if (!in.read(reinterpret_cast<char*>(dist[startRow + r].data()), vertices * sizeof(int))) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Periodic checkpointing for floydWarshallMPI. A checkpoint tagged k holds every
+// rank's own rows after rounds 0..k-1, so a restart resumes at the newest k
+// for which every rank has a complete file.
+struct CheckpointOptions {
+    std::string directory;      // Empty disables checkpointing
+    size_t everyRounds = 0;     // Checkpoint every N values of k (0 = off)
+    double everySeconds = 0.0;  // Checkpoint after T seconds of wall-clock time (0 = off)
+    bool restart = false;       // Resume from the latest consistent checkpoint
+
+    bool enabled() const { return !directory.empty() && (everyRounds > 0 || everySeconds > 0.0); }
+};
+
+namespace checkpoint {
+    // Writes one rank's row partition in a background thread. The rows are copied
+    // into a staging buffer first, so the caller can keep updating them while
+    // the file is written.
+    class PartitionWriter {
+    public:
+        // Removes this rank's files from earlier runs except round resumeK (0 on a
+        // fresh run), so stale rounds can neither be pruned late nor restored.
+        // inputHash identifies the rank's input rows (see hashRows).
+        PartitionWriter(std::string directory, int rank, int size, size_t vertices,
+                        size_t startRow, size_t numRows, uint64_t inputHash, size_t resumeK);
+        ~PartitionWriter();
+
+        PartitionWriter(const PartitionWriter&) = delete;
+        PartitionWriter& operator=(const PartitionWriter&) = delete;
+
+        // Snapshot rows [startRow, startRow + numRows) and write them for round nextK
+        void start(size_t nextK, const std::vector<std::vector<int>>& dist);
+
+        // Block until the in-flight write (if any) has finished
+        void wait();
+
+        // Round of the newest checkpoint fully written by this rank, or 0 if none
+        size_t lastCompleted() const { return completedK; }
+
+        // Delete this rank's checkpoint files older than round k
+        void pruneBefore(size_t k);
+
+    private:
+        std::string directory;
+        int rank;
+        int size;
+        size_t vertices;
+        size_t startRow;
+        size_t numRows;
+        uint64_t inputHash;
+
+        std::vector<int> staging;
+        std::thread worker;
+        std::atomic<size_t> completedK{0};
+        std::vector<size_t> writtenRounds;
+    };
+
+    // Path of a rank's partition file for round k
+    std::string partitionPath(const std::string& directory, int rank, size_t k);
+
+    // Hash of rows [startRow, startRow + numRows) of the input, taken before round 0
+    // and stored in every checkpoint so a restart cannot resume another graph
+    uint64_t hashRows(const std::vector<std::vector<int>>& dist, size_t startRow, size_t numRows);
+
+    // Rounds this rank has a complete partition file for, newest first. Sets
+    // otherInput if a file matches this partition but was written for another input.
+    std::vector<size_t> availableRounds(const std::string& directory, int rank, int size,
+                                        size_t vertices, size_t startRow, size_t numRows,
+                                        uint64_t inputHash, bool& otherInput);
+
+    // Load a rank's rows for round k into dist; returns false if the file is
+    // missing or does not match this partition
+    bool readPartition(const std::string& directory, int rank, int size, size_t vertices,
+                       size_t startRow, size_t numRows, uint64_t inputHash, size_t k,
+                       std::vector<std::vector<int>>& dist);
+}
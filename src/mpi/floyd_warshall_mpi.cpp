@@ -1,15 +1,69 @@
 #include "common/graph.hpp"
+#include "common/reachability_matrix.hpp"
+#include "common/symmetric_graph.hpp"
 #include "common/utils.hpp"
+#include "mpi/checkpoint.hpp"
 #include <mpi.h>
 #include <vector>
 #include <chrono>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
 
-Graph floydWarshallMPI(const Graph& graph, int rank, int size) {
+// Rank that owns row i under the block row distribution used below
+static int rowOwner(size_t i, int rowsPerProc, int extraRows) {
+    const size_t bigBlock = static_cast<size_t>(extraRows) * (rowsPerProc + 1);
+    if (i < bigBlock) {
+        return static_cast<int>(i / (rowsPerProc + 1));
+    }
+    return extraRows + static_cast<int>((i - bigBlock) / rowsPerProc);
+}
+
+// Broadcast rows [first, last) of matrix from root. Rows are separate vectors, so
+// they are packed into a bounded staging buffer (about 4 MB) to send many rows per
+// MPI_Bcast without allocating a second matrix.
+void broadcastRows(std::vector<std::vector<int>>& matrix, size_t first, size_t last, int root, int rank) {
+    if (first >= last) {
+        return;
+    }
+    const size_t V = matrix[first].size();
+    const size_t maxChunkInts = size_t{1} << 20;
+    const size_t rowsPerChunk = std::max<size_t>(1, maxChunkInts / V);
+
+    if (rowsPerChunk == 1) {
+        for (size_t i = first; i < last; i++) {
+            MPI_Bcast(matrix[i].data(), V, MPI_INT, root, MPI_COMM_WORLD);
+        }
+        return;
+    }
+
+    std::vector<int> buffer(std::min(rowsPerChunk, last - first) * V);
+    for (size_t chunkStart = first; chunkStart < last; chunkStart += rowsPerChunk) {
+        const size_t chunkRows = std::min(rowsPerChunk, last - chunkStart);
+        if (rank == root) {
+            for (size_t r = 0; r < chunkRows; r++) {
+                std::copy(matrix[chunkStart + r].begin(), matrix[chunkStart + r].end(),
+                          buffer.begin() + r * V);
+            }
+        }
+        MPI_Bcast(buffer.data(), chunkRows * V, MPI_INT, root, MPI_COMM_WORLD);
+        if (rank != root) {
+            for (size_t r = 0; r < chunkRows; r++) {
+                std::copy(buffer.begin() + r * V, buffer.begin() + (r + 1) * V,
+                          matrix[chunkStart + r].begin());
+            }
+        }
+    }
+}
+
+Graph& floydWarshallMPIInPlace(Graph& graph, int rank, int size, const CheckpointOptions& checkpointing) {
     const size_t V = graph.size();
-    Graph result = graph;
-    auto& dist = result.getMatrix();
+    auto& dist = graph.getMatrix();
 
     // Calculate rows per process
     const int rowsPerProc = V / size;
@@ -22,22 +76,105 @@ Graph floydWarshallMPI(const Graph& graph, int rank, int size) {
     // Buffer for broadcasting k-th row
     std::vector<int> kthRow(V);
 
-    for (size_t k = 0; k < V; k++) {
-        // Find the process that owns row k
-        int kOwner = 0;
-        int tmpRows = 0;
-        for (int p = 0; p < size; p++) {
-            int pRows = (p < extraRows) ? rowsPerProc + 1 : rowsPerProc;
-            if (k >= tmpRows && k < tmpRows + pRows) {
-                kOwner = p;
+    // Checkpoints are tied to the input, so a restart with another graph of the
+    // same size cannot resume from them
+    const uint64_t inputHash = (checkpointing.enabled() || checkpointing.restart) ?
+                               checkpoint::hashRows(dist, startRow, myRows) : 0;
+
+    // Resume from the newest round every rank has a complete file for. Only owned
+    // rows are restored; other rows are never read before the final gather.
+    size_t firstK = 0;
+    if (checkpointing.restart && !checkpointing.directory.empty()) {
+        bool otherInput = false;
+        const std::vector<size_t> ownRounds = checkpoint::availableRounds(checkpointing.directory, rank, size,
+                                                                         V, startRow, myRows, inputHash,
+                                                                         otherInput);
+        int foreign = otherInput ? 1 : 0;
+        MPI_Allreduce(MPI_IN_PLACE, &foreign, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+        if (foreign) {
+            throw std::runtime_error("Checkpoint in " + checkpointing.directory +
+                                     " was written for a different input graph");
+        }
+
+        // The newest common round is at most the smallest of the ranks' newest
+        // rounds below the bound; try that, and lower the bound if a rank lacks it
+        unsigned long long bound = V;
+        while (bound > 0) {
+            unsigned long long candidate = 0;
+            for (size_t k : ownRounds) {
+                if (k <= bound) {
+                    candidate = k;
+                    break;
+                }
+            }
+            MPI_Allreduce(MPI_IN_PLACE, &candidate, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN, MPI_COMM_WORLD);
+            if (candidate == 0) {
                 break;
             }
-            tmpRows += pRows;
+
+            int present = (std::find(ownRounds.begin(), ownRounds.end(), candidate) != ownRounds.end()) ? 1 : 0;
+            MPI_Allreduce(MPI_IN_PLACE, &present, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+            if (present) {
+                firstK = candidate;
+                break;
+            }
+            bound = candidate - 1;
+        }
+
+        if (firstK > 0) {
+            int loaded = checkpoint::readPartition(checkpointing.directory, rank, size, V,
+                                                   startRow, myRows, inputHash, firstK, dist) ? 1 : 0;
+            MPI_Allreduce(MPI_IN_PLACE, &loaded, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+            if (!loaded) {
+                throw std::runtime_error("Checkpoint for round " + std::to_string(firstK) +
+                                         " is incomplete in " + checkpointing.directory);
+            }
         }
+    }
+
+    std::unique_ptr<checkpoint::PartitionWriter> writer;
+    if (checkpointing.enabled()) {
+        writer = std::make_unique<checkpoint::PartitionWriter>(checkpointing.directory, rank, size, V,
+                                                               startRow, myRows, inputHash, firstK);
+    }
+    auto lastCheckpoint = std::chrono::steady_clock::now();
+
+    // Once every rank has finished writing some round, older files are never
+    // restored and can be deleted; newer ones may still be incomplete elsewhere
+    auto pruneToConsistent = [&]() {
+        writer->wait();
+        unsigned long long consistentK = writer->lastCompleted();
+        MPI_Allreduce(MPI_IN_PLACE, &consistentK, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN, MPI_COMM_WORLD);
+        writer->pruneBefore(consistentK);
+    };
+
+    for (size_t k = firstK; k < V; k++) {
+        // Checkpoint the state before round k. Writes run in the background while
+        // later rounds proceed, so a crash mid-write falls back to the previous round.
+        if (writer && k > firstK) {
+            int due = (checkpointing.everyRounds > 0 && k % checkpointing.everyRounds == 0) ? 1 : 0;
+            if (checkpointing.everySeconds > 0.0) {
+                // Clocks differ across ranks, so the root decides for everyone
+                if (rank == 0) {
+                    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - lastCheckpoint;
+                    due = (due || elapsed.count() >= checkpointing.everySeconds) ? 1 : 0;
+                }
+                MPI_Bcast(&due, 1, MPI_INT, 0, MPI_COMM_WORLD);
+            }
+
+            if (due) {
+                pruneToConsistent();
+                writer->start(k, dist);
+                lastCheckpoint = std::chrono::steady_clock::now();
+            }
+        }
+
+        // Find the process that owns row k
+        const int kOwner = rowOwner(k, rowsPerProc, extraRows);
 
         // Owner of k-th row prepares data for broadcast
         if (rank == kOwner) {
-            kthRow = dist[k];
+            std::copy(dist[k].begin(), dist[k].end(), kthRow.begin());
         }
 
         // Broadcast k-th row to all processes
@@ -57,22 +194,201 @@ Graph floydWarshallMPI(const Graph& graph, int rank, int size) {
         }
     }
 
-    // Gather results
-    for (size_t i = 0; i < V; i++) {
-        int owner = 0;
-        int tmpRows = 0;
+    // The last checkpoint is complete here, so leave only that round on disk
+    if (writer) {
+        pruneToConsistent();
+    }
+
+    // Gather results directly into the caller's rows, one owner's block at a time
+    for (int p = 0; p < size; p++) {
+        const size_t pStart = (p < extraRows) ? p * (rowsPerProc + 1) : p * rowsPerProc + extraRows;
+        const size_t pRows = (p < extraRows) ? rowsPerProc + 1 : rowsPerProc;
+        broadcastRows(dist, pStart, pStart + pRows, p, rank);
+    }
+
+    return graph;
+}
+
+Graph& floydWarshallMPIInPlace(Graph& graph, int rank, int size) {
+    return floydWarshallMPIInPlace(graph, rank, size, CheckpointOptions());
+}
+
+Graph floydWarshallMPI(Graph&& graph, int rank, int size, const CheckpointOptions& checkpointing) {
+    floydWarshallMPIInPlace(graph, rank, size, checkpointing);
+    return std::move(graph);
+}
+
+Graph floydWarshallMPI(Graph&& graph, int rank, int size) {
+    floydWarshallMPIInPlace(graph, rank, size);
+    return std::move(graph);
+}
+
+Graph floydWarshallMPI(const Graph& graph, int rank, int size) {
+    return floydWarshallMPI(Graph(graph), rank, size);
+}
+
+// Row boundaries that give each rank about the same number of packed triangle
+// entries; rank r owns rows [bounds[r], bounds[r + 1]).
+static std::vector<size_t> triangleRowBounds(const SymmetricGraph& graph, int size) {
+    const size_t V = graph.size();
+    const size_t total = graph.getData().size();
+    std::vector<size_t> bounds(size + 1, V);
+    bounds[0] = 0;
+
+    size_t row = 0;
+    for (int r = 1; r < size; r++) {
+        const size_t target = total * r / size;
+        while (row < V && graph.rowOffset(row) < target) {
+            row++;
+        }
+        bounds[r] = row;
+    }
+
+    return bounds;
+}
+
+// Packed upper-triangle variant for undirected graphs. Round k needs row k of the
+// full matrix: entries j >= k come from the owner of row k as one shortened
+// broadcast, and entries j < k are column k of rows owned by lower ranks, gathered
+// from their owners. Ranks relax only the packed entries (i, j >= i) of their own
+// rows in place, so work, storage and the final gather are half the dense engine's.
+SymmetricGraph& floydWarshallSymmetricMPIInPlace(SymmetricGraph& graph, int rank, int size) {
+    const size_t V = graph.size();
+    auto& data = graph.getData();
+
+    const std::vector<size_t> bounds = triangleRowBounds(graph, size);
+    const size_t startRow = bounds[rank];
+    const size_t endRow = bounds[rank + 1];
+
+    std::vector<int> kthRow(V);
+    std::vector<int> counts(size);
+    std::vector<int> displs(size);
+
+    int kOwner = 0;
+    for (size_t k = 0; k < V; k++) {
+        while (k >= bounds[kOwner + 1]) {
+            kOwner++;
+        }
+
+        // Column part: each rank contributes (j, k) for its rows j < k
         for (int p = 0; p < size; p++) {
-            int pRows = (p < extraRows) ? rowsPerProc + 1 : rowsPerProc;
-            if (i >= tmpRows && i < tmpRows + pRows) {
-                owner = p;
-                break;
+            const size_t first = std::min(bounds[p], k);
+            const size_t last = std::min(bounds[p + 1], k);
+            counts[p] = static_cast<int>(last - first);
+            displs[p] = static_cast<int>(first);
+        }
+        for (size_t j = startRow; j < std::min(endRow, k); j++) {
+            kthRow[j] = data[graph.index(j, k)];
+        }
+        if (k > 0) {
+            MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                           kthRow.data(), counts.data(), displs.data(), MPI_INT, MPI_COMM_WORLD);
+        }
+
+        // Row part: the owner of row k broadcasts (k, j) for j >= k
+        if (rank == kOwner) {
+            std::copy(data.begin() + graph.rowOffset(k), data.begin() + graph.rowOffset(k) + (V - k),
+                      kthRow.begin() + k);
+        }
+        MPI_Bcast(kthRow.data() + k, V - k, MPI_INT, kOwner, MPI_COMM_WORLD);
+
+        // Each process updates its portion of rows
+        for (size_t i = startRow; i < endRow; i++) {
+            const int dik = kthRow[i];
+            if (dik == SymmetricGraph::INF) {
+                continue;
+            }
+            int* row = data.data() + graph.rowOffset(i) - i; // row[j] is (i, j)
+            for (size_t j = i; j < V; j++) {
+                if (kthRow[j] != SymmetricGraph::INF &&
+                    dik + kthRow[j] < row[j]) {
+                    row[j] = dik + kthRow[j];
+                }
+            }
+        }
+    }
+
+    // Gather results: each rank's rows are one contiguous run of the packed data,
+    // sent in chunks that fit an int count
+    for (int p = 0; p < size; p++) {
+        const size_t begin = (bounds[p] < V) ? graph.rowOffset(bounds[p]) : data.size();
+        const size_t end = (bounds[p + 1] < V) ? graph.rowOffset(bounds[p + 1]) : data.size();
+        for (size_t offset = begin; offset < end; offset += INT_MAX) {
+            const int count = static_cast<int>(std::min<size_t>(end - offset, INT_MAX));
+            MPI_Bcast(data.data() + offset, count, MPI_INT, p, MPI_COMM_WORLD);
+        }
+    }
+
+    return graph;
+}
+
+SymmetricGraph floydWarshallSymmetricMPI(SymmetricGraph&& graph, int rank, int size) {
+    floydWarshallSymmetricMPIInPlace(graph, rank, size);
+    return std::move(graph);
+}
+
+SymmetricGraph floydWarshallSymmetricMPI(const SymmetricGraph& graph, int rank, int size) {
+    return floydWarshallSymmetricMPI(SymmetricGraph(graph), rank, size);
+}
+
+// Bit-parallel transitive closure with the same block row distribution as
+// floydWarshallMPI. Each round broadcasts one packed row, V/64 words.
+ReachabilityMatrix& transitiveClosureMPIInPlace(ReachabilityMatrix& reach, int rank, int size) {
+    const size_t V = reach.size();
+    const size_t words = reach.wordsPerRow();
+
+    const size_t rowsPerProc = V / size;
+    const size_t extraRows = V % size;
+    auto blockStart = [&](int p) {
+        const size_t up = static_cast<size_t>(p);
+        return (up < extraRows) ? up * (rowsPerProc + 1) : up * rowsPerProc + extraRows;
+    };
+    const size_t startRow = blockStart(rank);
+    const size_t endRow = blockStart(rank + 1);
+
+    std::vector<uint64_t> kthRow(words);
+
+    for (size_t k = 0; k < V; k++) {
+        const int kOwner = rowOwner(k, static_cast<int>(rowsPerProc), static_cast<int>(extraRows));
+        if (rank == kOwner) {
+            std::copy(reach.row(k), reach.row(k) + words, kthRow.begin());
+        }
+        MPI_Bcast(kthRow.data(), words, MPI_UINT64_T, kOwner, MPI_COMM_WORLD);
+
+        const size_t kWord = k / ReachabilityMatrix::BITS_PER_WORD;
+        const uint64_t kMask = uint64_t{1} << (k % ReachabilityMatrix::BITS_PER_WORD);
+        for (size_t i = startRow; i < endRow; i++) {
+            uint64_t* iRow = reach.row(i);
+            if (i != k && (iRow[kWord] & kMask)) { // Row k is a fixed point of its round
+#pragma omp simd
+                for (size_t w = 0; w < words; w++) {
+                    iRow[w] |= kthRow[w];
+                }
             }
-            tmpRows += pRows;
         }
-        MPI_Bcast(dist[i].data(), V, MPI_INT, owner, MPI_COMM_WORLD);
     }
 
-    return result;
+    // Gather results: each rank's rows are contiguous, sent in chunks that fit an int count
+    auto& data = reach.getData();
+    for (int p = 0; p < size; p++) {
+        const size_t begin = blockStart(p) * words;
+        const size_t end = blockStart(p + 1) * words;
+        for (size_t offset = begin; offset < end; offset += INT_MAX) {
+            const int count = static_cast<int>(std::min<size_t>(end - offset, INT_MAX));
+            MPI_Bcast(data.data() + offset, count, MPI_UINT64_T, p, MPI_COMM_WORLD);
+        }
+    }
+
+    return reach;
+}
+
+ReachabilityMatrix transitiveClosureMPI(ReachabilityMatrix&& reach, int rank, int size) {
+    transitiveClosureMPIInPlace(reach, rank, size);
+    return std::move(reach);
+}
+
+ReachabilityMatrix transitiveClosureMPI(const ReachabilityMatrix& reach, int rank, int size) {
+    return transitiveClosureMPI(ReachabilityMatrix(reach), rank, size);
 }
 
 #ifndef TESTING
@@ -86,24 +402,44 @@ int main(int argc, char* argv[]) {
         // Process command line arguments
         size_t V = (argc > 1) ? std::stoul(argv[1]) : 5;
 
-        // Generate random graph on root process
-        Graph graph(V);
+        CheckpointOptions checkpointing;
+        for (int a = 2; a < argc; a++) {
+            const std::string arg = argv[a];
+            if (arg == "--restart") {
+                checkpointing.restart = true;
+            } else if (a + 1 < argc && arg == "--checkpoint-dir") {
+                checkpointing.directory = argv[++a];
+            } else if (a + 1 < argc && arg == "--checkpoint-every") {
+                checkpointing.everyRounds = std::stoul(argv[++a]);
+            } else if (a + 1 < argc && arg == "--checkpoint-seconds") {
+                checkpointing.everySeconds = std::stod(argv[++a]);
+            } else {
+                throw std::invalid_argument("Unknown argument: " + arg);
+            }
+        }
+        // Checkpoints only match the input they were written for, and this driver
+        // generates a new random graph on every run
+        if (checkpointing.restart) {
+            throw std::invalid_argument("--restart needs a reproducible input; this driver "
+                                        "generates a random graph on every run");
+        }
+
+        // Generate random graph on root process; other ranks only allocate the
+        // matrix they receive into, so no rank holds two copies
+        Graph graph = (rank == 0) ? Graph::generateRandom(V, 0.3) : Graph(V);
         if (rank == 0) {
-            graph = Graph::generateRandom(V, 0.3);
             std::cout << "Original graph:" << std::endl;
             graph.print();
         }
 
         // Broadcast the graph from root to all processes
-        for (size_t i = 0; i < V; i++) {
-            MPI_Bcast(graph.getMatrix()[i].data(), V, MPI_INT, 0, MPI_COMM_WORLD);
-        }
+        broadcastRows(graph.getMatrix(), 0, V, 0, rank);
 
         // Start timing
         auto start = std::chrono::high_resolution_clock::now();
 
         // Run Floyd-Warshall
-        Graph result = floydWarshallMPI(graph, rank, size);
+        Graph result = floydWarshallMPI(std::move(graph), rank, size, checkpointing);
 
         // End timing
         auto end = std::chrono::high_resolution_clock::now();
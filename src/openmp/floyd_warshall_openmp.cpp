@@ -1,14 +1,16 @@
 #include "common/graph.hpp"
+#include "common/reachability_matrix.hpp"
+#include "common/symmetric_graph.hpp"
 #include "common/utils.hpp"
 #include <omp.h>
 #include <chrono>
 #include <iostream>
 #include <vector>
+#include <algorithm>
 
-Graph floydWarshallOpenMP(const Graph& graph, int numThreads = 0) {
+Graph& floydWarshallOpenMPInPlace(Graph& graph, int numThreads = 0) {
     size_t V = graph.size();
-    Graph result = graph;
-    auto& dist = result.getMatrix();
+    auto& dist = graph.getMatrix();
 
     if (numThreads > 0) {
         omp_set_num_threads(numThreads);
@@ -29,7 +31,180 @@ Graph floydWarshallOpenMP(const Graph& graph, int numThreads = 0) {
         }
     }
 
-    return result;
+    return graph;
+}
+
+Graph floydWarshallOpenMP(Graph&& graph, int numThreads = 0) {
+    floydWarshallOpenMPInPlace(graph, numThreads);
+    return std::move(graph);
+}
+
+Graph floydWarshallOpenMP(const Graph& graph, int numThreads = 0) {
+    return floydWarshallOpenMP(Graph(graph), numThreads);
+}
+
+// Relax the tile starting at (iStart, jStart) through the vertices of tile kStart
+static void relaxTile(std::vector<std::vector<int>>& dist, size_t V, size_t tileSize,
+                      size_t iStart, size_t jStart, size_t kStart) {
+    const size_t iEnd = std::min(iStart + tileSize, V);
+    const size_t jEnd = std::min(jStart + tileSize, V);
+    const size_t kEnd = std::min(kStart + tileSize, V);
+
+    for (size_t k = kStart; k < kEnd; k++) {
+        const int* kRow = dist[k].data();
+        for (size_t i = iStart; i < iEnd; i++) {
+            const int dik = dist[i][k];
+            if (dik == Graph::INF) {
+                continue;
+            }
+            int* iRow = dist[i].data();
+#pragma omp simd
+            for (size_t j = jStart; j < jEnd; j++) {
+                const int candidate = (kRow[j] == Graph::INF) ? Graph::INF : dik + kRow[j];
+                iRow[j] = std::min(iRow[j], candidate);
+            }
+        }
+    }
+}
+
+// Cache-blocked variant: each k-tile updates the diagonal tile, then its row and
+// column of tiles, then every remaining tile, so a tile's working set stays in cache.
+Graph& floydWarshallBlockedInPlace(Graph& graph, int numThreads, size_t tileSize) {
+    const size_t V = graph.size();
+    auto& dist = graph.getMatrix();
+
+    if (tileSize == 0) {
+        throw std::invalid_argument("Tile size must be positive");
+    }
+    if (numThreads > 0) {
+        omp_set_num_threads(numThreads);
+    }
+
+    const size_t numTiles = (V + tileSize - 1) / tileSize;
+
+    for (size_t kt = 0; kt < numTiles; kt++) {
+        const size_t kStart = kt * tileSize;
+
+        // Phase 1: diagonal tile depends only on itself
+        relaxTile(dist, V, tileSize, kStart, kStart, kStart);
+
+        // Phase 2: tiles in row kt and column kt depend on the diagonal tile
+#pragma omp parallel for schedule(static)
+        for (size_t t = 0; t < numTiles; t++) {
+            if (t == kt) {
+                continue;
+            }
+            relaxTile(dist, V, tileSize, kStart, t * tileSize, kStart);
+            relaxTile(dist, V, tileSize, t * tileSize, kStart, kStart);
+        }
+
+        // Phase 3: remaining tiles depend on their row and column tiles
+#pragma omp parallel for collapse(2) schedule(static)
+        for (size_t it = 0; it < numTiles; it++) {
+            for (size_t jt = 0; jt < numTiles; jt++) {
+                if (it != kt && jt != kt) {
+                    relaxTile(dist, V, tileSize, it * tileSize, jt * tileSize, kStart);
+                }
+            }
+        }
+    }
+
+    return graph;
+}
+
+Graph floydWarshallBlocked(Graph&& graph, int numThreads, size_t tileSize) {
+    floydWarshallBlockedInPlace(graph, numThreads, tileSize);
+    return std::move(graph);
+}
+
+Graph floydWarshallBlocked(const Graph& graph, int numThreads, size_t tileSize) {
+    return floydWarshallBlocked(Graph(graph), numThreads, tileSize);
+}
+
+// Packed upper-triangle variant for undirected graphs; see floydWarshallSymmetric
+SymmetricGraph& floydWarshallSymmetricOpenMPInPlace(SymmetricGraph& graph, int numThreads = 0) {
+    const size_t V = graph.size();
+    auto& data = graph.getData();
+    std::vector<int> kthRow(V);
+
+    if (numThreads > 0) {
+        omp_set_num_threads(numThreads);
+    }
+
+    for (size_t k = 0; k < V; k++) {
+        for (size_t j = 0; j < k; j++) {
+            kthRow[j] = data[graph.index(j, k)];
+        }
+        for (size_t j = k; j < V; j++) {
+            kthRow[j] = data[graph.index(k, j)];
+        }
+
+        // Row i has V - i entries, so hand out small chunks to balance the triangle
+#pragma omp parallel for schedule(dynamic, 16)
+        for (size_t i = 0; i < V; i++) {
+            const int dik = kthRow[i];
+            if (dik == SymmetricGraph::INF) {
+                continue;
+            }
+            int* row = data.data() + graph.rowOffset(i) - i; // row[j] is (i, j)
+#pragma omp simd
+            for (size_t j = i; j < V; j++) {
+                const int candidate = (kthRow[j] == SymmetricGraph::INF) ? SymmetricGraph::INF : dik + kthRow[j];
+                row[j] = std::min(row[j], candidate);
+            }
+        }
+    }
+
+    return graph;
+}
+
+SymmetricGraph floydWarshallSymmetricOpenMP(SymmetricGraph&& graph, int numThreads = 0) {
+    floydWarshallSymmetricOpenMPInPlace(graph, numThreads);
+    return std::move(graph);
+}
+
+SymmetricGraph floydWarshallSymmetricOpenMP(const SymmetricGraph& graph, int numThreads = 0) {
+    return floydWarshallSymmetricOpenMP(SymmetricGraph(graph), numThreads);
+}
+
+// Bit-parallel transitive closure; see transitiveClosure. Row k is skipped: it is
+// a fixed point of its own round, and writing it while other threads read it as
+// kRow would be a data race even though the values do not change.
+ReachabilityMatrix& transitiveClosureOpenMPInPlace(ReachabilityMatrix& reach, int numThreads = 0) {
+    const size_t V = reach.size();
+    const size_t words = reach.wordsPerRow();
+
+    if (numThreads > 0) {
+        omp_set_num_threads(numThreads);
+    }
+
+    for (size_t k = 0; k < V; k++) {
+        const uint64_t* kRow = reach.row(k);
+        const size_t kWord = k / ReachabilityMatrix::BITS_PER_WORD;
+        const uint64_t kMask = uint64_t{1} << (k % ReachabilityMatrix::BITS_PER_WORD);
+
+#pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < V; i++) {
+            uint64_t* iRow = reach.row(i);
+            if (i != k && (iRow[kWord] & kMask)) {
+#pragma omp simd
+                for (size_t w = 0; w < words; w++) {
+                    iRow[w] |= kRow[w];
+                }
+            }
+        }
+    }
+
+    return reach;
+}
+
+ReachabilityMatrix transitiveClosureOpenMP(ReachabilityMatrix&& reach, int numThreads = 0) {
+    transitiveClosureOpenMPInPlace(reach, numThreads);
+    return std::move(reach);
+}
+
+ReachabilityMatrix transitiveClosureOpenMP(const ReachabilityMatrix& reach, int numThreads = 0) {
+    return transitiveClosureOpenMP(ReachabilityMatrix(reach), numThreads);
 }
 
 #ifndef TESTING
@@ -37,7 +212,7 @@ void runPerformanceTest(size_t V, int numThreads) {
     Graph graph = Graph::generateRandom(V, 0.3);
 
     auto start = std::chrono::high_resolution_clock::now();
-    Graph result = floydWarshallOpenMP(graph, numThreads);
+    Graph result = floydWarshallOpenMP(std::move(graph), numThreads);
     auto end = std::chrono::high_resolution_clock::now();
 
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -60,7 +235,7 @@ int main(int argc, char* argv[]) {
         graph.print();
 
         auto start = std::chrono::high_resolution_clock::now();
-        Graph result = floydWarshallOpenMP(graph, numThreads);
+        Graph result = floydWarshallOpenMP(std::move(graph), numThreads);
         auto end = std::chrono::high_resolution_clock::now();
 
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -1,16 +1,19 @@
 #include "common/graph.hpp"
+#include "autotune/auto_tuner.hpp"
 #include <chrono>
 #include <fstream>
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 #include <omp.h>
 #include <mpi.h>
 
 // Forward declarations of our implementations
-Graph floydWarshall(const Graph& graph);
-Graph floydWarshallOpenMP(const Graph& graph, int numThreads);
-Graph floydWarshallMPI(const Graph& graph, int rank, int size);
+Graph floydWarshall(Graph&& graph);
+Graph floydWarshallOpenMP(Graph&& graph, int numThreads);
+Graph floydWarshallMPI(Graph&& graph, int rank, int size);
+void broadcastRows(std::vector<std::vector<int>>& matrix, size_t first, size_t last, int root, int rank);
 
 struct TestResult {
     std::string implementation;
@@ -27,7 +30,7 @@ public:
         std::vector<TestResult> results;
         std::vector<size_t> verticesSizes = {100, 200, 500, 1000};
         std::vector<double> densities = {0.1, 0.3, 0.5};
-        std::vector<int> threadCounts = {1, 2, 4, 8};
+        std::vector<int> threadCounts = threadCountsForHardware();
 
         // Only root process generates test cases
         if (rank == 0) {
@@ -73,13 +76,24 @@ public:
     }
 
 private:
+    // Powers of two up to the detected core count, always including the core count
+    static std::vector<int> threadCountsForHardware() {
+        const int cores = std::max(autotune::detectHardware().cores, 1);
+        std::vector<int> counts;
+        for (int t = 1; t < cores; t *= 2) {
+            counts.push_back(t);
+        }
+        counts.push_back(cores);
+        return counts;
+    }
+
     static TestResult testSerial(size_t V, double density) {
         TestResult result = {"Serial", V, 1, density, 0.0, true};
 
         try {
             Graph g = Graph::generateRandom(V, density);
             auto start = std::chrono::high_resolution_clock::now();
-            Graph res = floydWarshall(g);
+            Graph res = floydWarshall(std::move(g));
             auto end = std::chrono::high_resolution_clock::now();
             result.time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
         } catch (...) {
@@ -95,7 +109,7 @@ private:
         try {
             Graph g = Graph::generateRandom(V, density);
             auto start = std::chrono::high_resolution_clock::now();
-            Graph res = floydWarshallOpenMP(g, threads);
+            Graph res = floydWarshallOpenMP(std::move(g), threads);
             auto end = std::chrono::high_resolution_clock::now();
             result.time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
         } catch (...) {
@@ -109,18 +123,14 @@ private:
         TestResult result = {"MPI", V, size, density, 0.0, true};
 
         try {
-            Graph g(V);
-            if (rank == 0) {
-                g = Graph::generateRandom(V, density);
-            }
+            // Only the root generates; the others allocate the matrix they receive into
+            Graph g = (rank == 0) ? Graph::generateRandom(V, density) : Graph(V);
 
             // Broadcast the graph to all processes
-            for (size_t i = 0; i < V; i++) {
-                MPI_Bcast(g.getMatrix()[i].data(), V, MPI_INT, 0, MPI_COMM_WORLD);
-            }
+            broadcastRows(g.getMatrix(), 0, V, 0, rank);
 
             auto start = std::chrono::high_resolution_clock::now();
-            Graph res = floydWarshallMPI(g, rank, size);
+            Graph res = floydWarshallMPI(std::move(g), rank, size);
             auto end = std::chrono::high_resolution_clock::now();
 
             // Only use timing from root process
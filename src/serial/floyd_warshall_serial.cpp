@@ -1,13 +1,15 @@
 // src/serial/floyd_warshall_serial.cpp
 #include "common/graph.hpp"
+#include "common/reachability_matrix.hpp"
+#include "common/symmetric_graph.hpp"
 #include "common/utils.hpp"
 #include <chrono>
 #include <iostream>
+#include <vector>
 
-Graph floydWarshall(const Graph& graph) {
+Graph& floydWarshallInPlace(Graph& graph) {
     size_t V = graph.size();
-    Graph result = graph; // Create a copy of the input graph
-    auto& dist = result.getMatrix();
+    auto& dist = graph.getMatrix();
 
     // Main Floyd-Warshall algorithm
     for (size_t k = 0; k < V; k++) {
@@ -22,7 +24,94 @@ Graph floydWarshall(const Graph& graph) {
         }
     }
 
-    return result;
+    return graph;
+}
+
+Graph floydWarshall(Graph&& graph) {
+    floydWarshallInPlace(graph);
+    return std::move(graph);
+}
+
+Graph floydWarshall(const Graph& graph) {
+    return floydWarshall(Graph(graph)); // Copy only when the caller keeps the input
+}
+
+// Floyd-Warshall on the packed upper triangle of an undirected graph. Row k is
+// unchanged during round k, so a snapshot of it (mirrored from column k for
+// j < k) serves every update and only entries with i <= j are relaxed.
+SymmetricGraph& floydWarshallSymmetricInPlace(SymmetricGraph& graph) {
+    const size_t V = graph.size();
+    auto& data = graph.getData();
+    std::vector<int> kthRow(V);
+
+    for (size_t k = 0; k < V; k++) {
+        for (size_t j = 0; j < k; j++) {
+            kthRow[j] = data[graph.index(j, k)];
+        }
+        for (size_t j = k; j < V; j++) {
+            kthRow[j] = data[graph.index(k, j)];
+        }
+
+        for (size_t i = 0; i < V; i++) {
+            const int dik = kthRow[i];
+            if (dik == SymmetricGraph::INF) {
+                continue;
+            }
+            int* row = data.data() + graph.rowOffset(i) - i; // row[j] is (i, j)
+            for (size_t j = i; j < V; j++) {
+                if (kthRow[j] != SymmetricGraph::INF &&
+                    dik + kthRow[j] < row[j]) {
+                    row[j] = dik + kthRow[j];
+                }
+            }
+        }
+    }
+
+    return graph;
+}
+
+SymmetricGraph floydWarshallSymmetric(SymmetricGraph&& graph) {
+    floydWarshallSymmetricInPlace(graph);
+    return std::move(graph);
+}
+
+SymmetricGraph floydWarshallSymmetric(const SymmetricGraph& graph) {
+    return floydWarshallSymmetric(SymmetricGraph(graph));
+}
+
+// Warshall's transitive closure on packed bit rows: row_i |= row_k whenever i
+// reaches k. Each OR covers 64 vertices per word. Row k is a fixed point of its
+// own round (row_k |= row_k), so it is skipped.
+ReachabilityMatrix& transitiveClosureInPlace(ReachabilityMatrix& reach) {
+    const size_t V = reach.size();
+    const size_t words = reach.wordsPerRow();
+
+    for (size_t k = 0; k < V; k++) {
+        const uint64_t* kRow = reach.row(k);
+        const size_t kWord = k / ReachabilityMatrix::BITS_PER_WORD;
+        const uint64_t kMask = uint64_t{1} << (k % ReachabilityMatrix::BITS_PER_WORD);
+
+        for (size_t i = 0; i < V; i++) {
+            uint64_t* iRow = reach.row(i);
+            if (i != k && (iRow[kWord] & kMask)) {
+#pragma omp simd
+                for (size_t w = 0; w < words; w++) {
+                    iRow[w] |= kRow[w];
+                }
+            }
+        }
+    }
+
+    return reach;
+}
+
+ReachabilityMatrix transitiveClosure(ReachabilityMatrix&& reach) {
+    transitiveClosureInPlace(reach);
+    return std::move(reach);
+}
+
+ReachabilityMatrix transitiveClosure(const ReachabilityMatrix& reach) {
+    return transitiveClosure(ReachabilityMatrix(reach));
 }
 
 #ifndef TESTING
@@ -43,7 +132,7 @@ int main(int argc, char* argv[]) {
         // Measure execution time
         auto start = std::chrono::high_resolution_clock::now();
 
-        Graph result = floydWarshall(graph);
+        Graph result = floydWarshall(std::move(graph));
 
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "autotune/auto_tuner.hpp"
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+
+Graph floydWarshall(const Graph& graph);
+
+class AutoTunerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        profilePath = ::testing::TempDir() + "auto_tuner_test_profile.txt";
+        std::remove(profilePath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(profilePath.c_str());
+    }
+
+    std::string profilePath;
+};
+
+// Test hardware detection reports usable values
+TEST_F(AutoTunerTest, DetectHardware) {
+    autotune::HardwareInfo hw = autotune::detectHardware();
+    EXPECT_GE(hw.cores, 1);
+    EXPECT_GT(hw.l1Bytes, 0);
+    EXPECT_GE(hw.l2Bytes, hw.l1Bytes);
+    EXPECT_GE(hw.numaNodes, 1);
+    EXPECT_GE(hw.simdWidth, 1);
+}
+
+// Test graph statistics
+TEST_F(AutoTunerTest, MeasureGraph) {
+    Graph g(3);
+    g.setEdge(0, 1, 4);
+    g.setEdge(1, 2, -1);
+
+    autotune::GraphStats stats = autotune::measureGraph(g);
+    EXPECT_EQ(stats.vertices, 3);
+    EXPECT_NEAR(stats.density, 2.0 / 6.0, 1e-9);
+    EXPECT_TRUE(stats.hasNegativeWeights);
+}
+
+// Test negative weights exclude the sparse engine
+TEST_F(AutoTunerTest, CandidatesSkipSparseWithNegativeWeights) {
+    autotune::HardwareInfo hw = autotune::detectHardware();
+    autotune::GraphStats stats = {100, 0.1, true};
+
+    for (const auto& choice : autotune::candidateChoices(hw, stats)) {
+        EXPECT_NE(choice.engine, autotune::Engine::Sparse);
+        if (choice.engine == autotune::Engine::Blocked) {
+            EXPECT_LT(choice.tileSize, stats.vertices);
+            EXPECT_EQ(choice.tileSize % hw.simdWidth, 0);
+        }
+    }
+}
+
+// Test tiles are filtered against the full graph and the sub-block can hold them
+TEST_F(AutoTunerTest, CalibrationSizeCoversLargestTile) {
+    autotune::HardwareInfo hw = autotune::detectHardware();
+    autotune::GraphStats stats = {30000, 0.1, false};
+
+    size_t largestTile = 0;
+    for (const auto& choice : autotune::candidateChoices(hw, stats)) {
+        if (choice.engine == autotune::Engine::Blocked) {
+            largestTile = std::max(largestTile, choice.tileSize);
+        }
+    }
+    ASSERT_GT(largestTile, 0);
+
+    size_t n = autotune::calibrationVertices(hw, stats.vertices);
+    EXPECT_LE(n, stats.vertices);
+    EXPECT_GE(n, std::min<size_t>(2 * largestTile, 1024));
+    EXPECT_EQ(autotune::calibrationVertices(hw, 40), 40);
+}
+
+// Test profiles written in the older six-column format are ignored
+TEST_F(AutoTunerTest, ProfileSkipsOldFormat) {
+    {
+        std::ofstream out(profilePath);
+        out << "key blocked 4 64 8 12.5\n";
+    }
+    autotune::TuningProfile profile(profilePath);
+    profile.load();
+    autotune::TuningChoice loaded{};
+    EXPECT_FALSE(profile.lookup("key", loaded));
+}
+
+// Test profiles survive a save/load round trip
+TEST_F(AutoTunerTest, ProfileRoundTrip) {
+    autotune::TuningProfile profile(profilePath);
+    autotune::TuningChoice choice = {autotune::Engine::Blocked, 4, 64, 12.5};
+    profile.store("key", choice);
+    profile.save();
+
+    autotune::TuningProfile reloaded(profilePath);
+    reloaded.load();
+    autotune::TuningChoice loaded{};
+    ASSERT_TRUE(reloaded.lookup("key", loaded));
+    EXPECT_EQ(loaded.engine, autotune::Engine::Blocked);
+    EXPECT_EQ(loaded.threads, 4);
+    EXPECT_EQ(loaded.tileSize, 64);
+    EXPECT_DOUBLE_EQ(loaded.timeMs, 12.5);
+    EXPECT_FALSE(reloaded.lookup("missing", loaded));
+}
+
+// Test a persisted choice is reused instead of recalibrating
+TEST_F(AutoTunerTest, SelectEngineUsesProfile) {
+    Graph g = Graph::generateRandom(40, 0.3);
+    std::string key = autotune::TuningProfile::key(autotune::detectHardware(), autotune::measureGraph(g));
+
+    autotune::TuningProfile profile(profilePath);
+    profile.store(key, {autotune::Engine::Sparse, 1, 0, 0.0});
+
+    autotune::TuningChoice choice = autotune::selectEngine(g, profile);
+    EXPECT_EQ(choice.engine, autotune::Engine::Sparse);
+    EXPECT_FALSE(std::ifstream(profilePath).good()); // No calibration, nothing written
+}
+
+// Test calibration persists its choice and the result is correct
+TEST_F(AutoTunerTest, SolveCalibratesAndPersists) {
+    Graph g = Graph::generateRandom(40, 0.3);
+    Graph expected = floydWarshall(g);
+
+    Graph result = autotune::solveShortestPaths(Graph(g), profilePath);
+
+    autotune::TuningProfile profile(profilePath);
+    profile.load();
+    autotune::TuningChoice choice{};
+    std::string key = autotune::TuningProfile::key(autotune::detectHardware(), autotune::measureGraph(g));
+    EXPECT_TRUE(profile.lookup(key, choice));
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(expected.getEdge(i, j), result.getEdge(i, j));
+        }
+    }
+}
+
+// Test an unwritable profile does not stop the solve
+TEST_F(AutoTunerTest, SolveWithUnwritableProfile) {
+    Graph g = Graph::generateRandom(30, 0.3);
+    Graph expected = floydWarshall(g);
+
+    Graph result = autotune::solveShortestPaths(Graph(g), ::testing::TempDir() + "missing_dir/profile.txt");
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(expected.getEdge(i, j), result.getEdge(i, j));
+        }
+    }
+}
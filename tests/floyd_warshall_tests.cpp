@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 #include "common/graph.hpp"
+#include "common/symmetric_graph.hpp"
+#include "common/reachability_matrix.hpp"
+#include "mpi/checkpoint.hpp"
+#include <filesystem>
+#include <fstream>
 #include <mpi.h>
 #include <omp.h>
 
@@ -7,6 +12,22 @@
 Graph floydWarshall(const Graph& graph);
 Graph floydWarshallOpenMP(const Graph& graph, int numThreads = 0);
 Graph floydWarshallMPI(const Graph& graph, int rank, int size);
+Graph floydWarshallOpenMP(Graph&& graph, int numThreads = 0);
+Graph floydWarshallMPI(Graph&& graph, int rank, int size);
+Graph floydWarshallMPI(Graph&& graph, int rank, int size, const CheckpointOptions& checkpointing);
+Graph& floydWarshallInPlace(Graph& graph);
+Graph floydWarshallBlocked(const Graph& graph, int numThreads, size_t tileSize);
+Graph allPairsDijkstra(const Graph& graph, int numThreads = 0);
+std::vector<std::vector<int>> multiSourceShortestPaths(const Graph& graph,
+                                                       const std::vector<size_t>& sources,
+                                                       const std::vector<size_t>& targets = {},
+                                                       int numThreads = 0);
+SymmetricGraph floydWarshallSymmetric(const SymmetricGraph& graph);
+SymmetricGraph floydWarshallSymmetricOpenMP(const SymmetricGraph& graph, int numThreads = 0);
+SymmetricGraph floydWarshallSymmetricMPI(const SymmetricGraph& graph, int rank, int size);
+ReachabilityMatrix transitiveClosure(const ReachabilityMatrix& reach);
+ReachabilityMatrix transitiveClosureOpenMP(const ReachabilityMatrix& reach, int numThreads = 0);
+ReachabilityMatrix transitiveClosureMPI(const ReachabilityMatrix& reach, int rank, int size);
 
 class FloydWarshallTest : public ::testing::Test {
 protected:
@@ -107,6 +128,280 @@ TEST_F(FloydWarshallTest, MPIMatchesSerial) {
     }
 }
 
+TEST_F(FloydWarshallTest, InPlaceReusesCallerBuffer) {
+    Graph g(4);
+    g.setEdge(0, 1, 3);
+    g.setEdge(1, 2, 2);
+    g.setEdge(2, 3, 1);
+    Graph expected = floydWarshall(g);
+
+    const int* rowData = g.getMatrix()[0].data();
+    Graph& result = floydWarshallInPlace(g);
+
+    EXPECT_EQ(&result, &g);
+    EXPECT_EQ(g.getMatrix()[0].data(), rowData);
+    EXPECT_EQ(g.getEdge(0, 3), expected.getEdge(0, 3));
+}
+
+TEST_F(FloydWarshallTest, MoveOverloadsKeepBuffer) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    Graph g(20);
+    for (size_t i = 0; i < g.size(); ++i) {
+        g.setEdge(i, (i + 1) % g.size(), static_cast<int>(i % 7) + 1);
+        g.setEdge(i, (i * 3) % g.size(), 10);
+    }
+    Graph expected = floydWarshall(g);
+
+    Graph ompInput = g;
+    const int* ompRow = ompInput.getMatrix()[0].data();
+    Graph ompResult = floydWarshallOpenMP(std::move(ompInput), 2);
+    EXPECT_EQ(ompResult.getMatrix()[0].data(), ompRow);
+
+    Graph mpiInput = g;
+    const int* mpiRow = mpiInput.getMatrix()[0].data();
+    Graph mpiResult = floydWarshallMPI(std::move(mpiInput), rank, size);
+    EXPECT_EQ(mpiResult.getMatrix()[0].data(), mpiRow);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(expected.getEdge(i, j), ompResult.getEdge(i, j));
+            EXPECT_EQ(expected.getEdge(i, j), mpiResult.getEdge(i, j));
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, BlockedMatchesSerial) {
+    Graph g = Graph::generateRandom(50, 0.2);
+    Graph serialResult = floydWarshall(g);
+
+    // Tile sizes that divide V, leave a ragged edge, and exceed V
+    for (size_t tile : {5, 8, 64}) {
+        Graph blockedResult = floydWarshallBlocked(g, 2, tile);
+        for (size_t i = 0; i < g.size(); ++i) {
+            for (size_t j = 0; j < g.size(); ++j) {
+                EXPECT_EQ(serialResult.getEdge(i, j), blockedResult.getEdge(i, j));
+            }
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, SparseMatchesSerial) {
+    Graph g = Graph::generateRandom(60, 0.05);
+    Graph serialResult = floydWarshall(g);
+    Graph sparseResult = allPairsDijkstra(g, 2);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(serialResult.getEdge(i, j), sparseResult.getEdge(i, j));
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, SparseRejectsNegativeWeights) {
+    Graph g(3);
+    g.setEdge(0, 1, -2);
+
+    EXPECT_THROW(allPairsDijkstra(g), std::invalid_argument);
+}
+
+TEST_F(FloydWarshallTest, SymmetricMatchesSerial) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // Deterministic so every MPI rank starts from the same graph
+    SymmetricGraph g(30);
+    for (size_t i = 0; i < g.size(); ++i) {
+        g.setEdge(i, (i + 1) % g.size(), static_cast<int>(i % 5) + 1);
+        g.setEdge(i, (i * 7) % g.size(), 12);
+    }
+
+    Graph serialResult = floydWarshall(g.toGraph());
+    SymmetricGraph symmetricResult = floydWarshallSymmetric(g);
+    SymmetricGraph ompResult = floydWarshallSymmetricOpenMP(g, 2);
+    SymmetricGraph mpiResult = floydWarshallSymmetricMPI(g, rank, size);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(serialResult.getEdge(i, j), symmetricResult.getEdge(i, j));
+            EXPECT_EQ(serialResult.getEdge(i, j), ompResult.getEdge(i, j));
+            EXPECT_EQ(serialResult.getEdge(i, j), mpiResult.getEdge(i, j));
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, ClosureMatchesSerial) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // More than one word per row, deterministic for every MPI rank
+    Graph g(150);
+    for (size_t i = 0; i < g.size(); ++i) {
+        if (i % 10 != 9) {
+            g.setEdge(i, (i + 1) % g.size(), 1);
+        }
+        g.setEdge(i, (i * 13) % g.size(), 1);
+    }
+
+    Graph serialResult = floydWarshall(g);
+    ReachabilityMatrix reach = ReachabilityMatrix::fromGraph(g);
+    ReachabilityMatrix closure = transitiveClosure(reach);
+    ReachabilityMatrix ompClosure = transitiveClosureOpenMP(reach, 2);
+    ReachabilityMatrix mpiClosure = transitiveClosureMPI(reach, rank, size);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            bool expected = serialResult.getEdge(i, j) != Graph::INF;
+            EXPECT_EQ(expected, closure.getEdge(i, j));
+            EXPECT_EQ(expected, ompClosure.getEdge(i, j));
+            EXPECT_EQ(expected, mpiClosure.getEdge(i, j));
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, MultiSourceMatchesSerial) {
+    Graph g = Graph::generateRandom(60, 0.1);
+    Graph serialResult = floydWarshall(g);
+    std::vector<size_t> sources = {0, 17, 59, 17};
+    std::vector<size_t> targets = {3, 0, 42};
+
+    auto rows = multiSourceShortestPaths(g, sources, {}, 2);
+    auto submatrix = multiSourceShortestPaths(g, sources, targets, 2);
+
+    ASSERT_EQ(rows.size(), sources.size());
+    ASSERT_EQ(submatrix.size(), sources.size());
+    for (size_t s = 0; s < sources.size(); ++s) {
+        ASSERT_EQ(rows[s].size(), g.size());
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(serialResult.getEdge(sources[s], j), rows[s][j]);
+        }
+        ASSERT_EQ(submatrix[s].size(), targets.size());
+        for (size_t t = 0; t < targets.size(); ++t) {
+            EXPECT_EQ(serialResult.getEdge(sources[s], targets[t]), submatrix[s][t]);
+        }
+    }
+}
+
+TEST_F(FloydWarshallTest, MultiSourceNegativeWeights) {
+    Graph g(4);
+    g.setEdge(0, 1, 4);
+    g.setEdge(0, 2, 5);
+    g.setEdge(2, 1, -3);
+    g.setEdge(1, 3, 2);
+    Graph serialResult = floydWarshall(g);
+
+    auto rows = multiSourceShortestPaths(g, {0, 2});
+    for (size_t j = 0; j < g.size(); ++j) {
+        EXPECT_EQ(serialResult.getEdge(0, j), rows[0][j]);
+        EXPECT_EQ(serialResult.getEdge(2, j), rows[1][j]);
+    }
+    EXPECT_EQ(rows[0][3], 4);  // Path 0->2->1->3
+
+    g.setEdge(1, 2, 1); // Cycle 1->2->1 of weight -2
+    EXPECT_THROW(multiSourceShortestPaths(g, {0}), std::runtime_error);
+    EXPECT_THROW(multiSourceShortestPaths(g, {4}), std::out_of_range);
+}
+
+TEST_F(FloydWarshallTest, MPICheckpointRestart) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    const std::string directory = ::testing::TempDir() + "fw_checkpoint_test";
+    if (rank == 0) {
+        std::filesystem::remove_all(directory);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    Graph g(24);
+    for (size_t i = 0; i < g.size(); ++i) {
+        g.setEdge(i, (i + 1) % g.size(), static_cast<int>(i % 4) + 1);
+        g.setEdge(i, (i * 5) % g.size(), 9);
+    }
+    Graph expected = floydWarshall(g);
+
+    CheckpointOptions checkpointing;
+    checkpointing.directory = directory;
+    checkpointing.everyRounds = 4;
+    Graph result = floydWarshallMPI(Graph(g), rank, size, checkpointing);
+
+    // Older rounds are pruned once the last one is complete on every rank
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (rank == 0) {
+        size_t files = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            (void)entry;
+            files++;
+        }
+        EXPECT_EQ(files, static_cast<size_t>(size));
+        for (int r = 0; r < size; ++r) {
+            EXPECT_TRUE(std::filesystem::exists(checkpoint::partitionPath(directory, r, 20)));
+        }
+    }
+
+    checkpointing.restart = true;
+    Graph resumed = floydWarshallMPI(Graph(g), rank, size, checkpointing);
+
+    // Checkpoints of another graph with the same size must not be resumed
+    Graph other = g;
+    other.setEdge(0, 1, 7);
+    EXPECT_THROW(floydWarshallMPI(Graph(other), rank, size, checkpointing), std::runtime_error);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(expected.getEdge(i, j), result.getEdge(i, j));
+            EXPECT_EQ(expected.getEdge(i, j), resumed.getEdge(i, j));
+        }
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (rank == 0) {
+        std::filesystem::remove_all(directory);
+    }
+}
+
+TEST_F(FloydWarshallTest, MPISingleCheckpointRestart) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    const std::string directory = ::testing::TempDir() + "fw_single_checkpoint_test";
+    if (rank == 0) {
+        std::filesystem::remove_all(directory);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    Graph g(24);
+    for (size_t i = 0; i < g.size(); ++i) {
+        g.setEdge(i, (i + 3) % g.size(), static_cast<int>(i % 5) + 1);
+    }
+    Graph expected = floydWarshall(g);
+
+    // Only round 12 is checkpointed; it must be restorable without a later one
+    CheckpointOptions checkpointing;
+    checkpointing.directory = directory;
+    checkpointing.everyRounds = 12;
+    floydWarshallMPI(Graph(g), rank, size, checkpointing);
+
+    checkpointing.restart = true;
+    Graph resumed = floydWarshallMPI(Graph(g), rank, size, checkpointing);
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        for (size_t j = 0; j < g.size(); ++j) {
+            EXPECT_EQ(expected.getEdge(i, j), resumed.getEdge(i, j));
+        }
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (rank == 0) {
+        std::filesystem::remove_all(directory);
+    }
+}
+
 TEST_F(FloydWarshallTest, CyclicGraph) {
     Graph g(4);
     g.setEdge(0, 1, 3);
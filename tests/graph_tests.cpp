@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "common/graph.hpp"
+#include "common/symmetric_graph.hpp"
+#include "common/reachability_matrix.hpp"
 #include <stdexcept>
 
 class GraphTest : public ::testing::Test {
@@ -109,4 +111,99 @@ TEST_F(GraphTest, MatrixAccess) {
     auto& matrix = g.getMatrix();
     matrix[1][2] = 3;
     EXPECT_EQ(g.getEdge(1, 2), 3);
+}
+
+// Test adopting and releasing an external matrix
+TEST_F(GraphTest, MatrixMoveConstruction) {
+    std::vector<std::vector<int>> matrix = {{0, 2}, {Graph::INF, 0}};
+    const int* rowData = matrix[0].data();
+
+    Graph g(std::move(matrix));
+    EXPECT_EQ(g.size(), 2);
+    EXPECT_EQ(g.getEdge(0, 1), 2);
+    EXPECT_EQ(g.getMatrix()[0].data(), rowData);
+
+    auto released = g.releaseMatrix();
+    EXPECT_EQ(released[0].data(), rowData);
+    EXPECT_EQ(g.size(), 0);
+}
+
+// Test rejecting non-square matrices
+TEST_F(GraphTest, MatrixConstructionThrowsOnBadShape) {
+    EXPECT_THROW(Graph(std::vector<std::vector<int>>{}), std::invalid_argument);
+    EXPECT_THROW(Graph(std::vector<std::vector<int>>{{0, 1}, {0}}), std::invalid_argument);
+}
+
+// Test symmetric graph construction and packed size
+TEST_F(GraphTest, SymmetricConstructorCreatesValidGraph) {
+    SymmetricGraph g(4);
+    EXPECT_EQ(g.size(), 4);
+    EXPECT_EQ(g.getData().size(), 10); // Upper triangle including diagonal
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(g.getEdge(i, j), i == j ? 0 : SymmetricGraph::INF);
+        }
+    }
+    EXPECT_THROW(SymmetricGraph(0), std::invalid_argument);
+}
+
+// Test symmetric edges read back in both directions
+TEST_F(GraphTest, SymmetricEdgeSetAndGet) {
+    SymmetricGraph g(3);
+    g.setEdge(2, 0, 7);
+    EXPECT_EQ(g.getEdge(0, 2), 7);
+    EXPECT_EQ(g.getEdge(2, 0), 7);
+    EXPECT_THROW(g.setEdge(3, 0, 5), std::out_of_range);
+    EXPECT_THROW(g.getEdge(0, 3), std::out_of_range);
+}
+
+// Test conversion to and from the dense representation
+TEST_F(GraphTest, SymmetricDenseConversion) {
+    SymmetricGraph g = SymmetricGraph::generateRandom(8, 0.5);
+    Graph dense = g.toGraph();
+    SymmetricGraph back = SymmetricGraph::fromGraph(dense);
+
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            EXPECT_EQ(dense.getEdge(i, j), g.getEdge(i, j));
+            EXPECT_EQ(back.getEdge(i, j), g.getEdge(i, j));
+        }
+    }
+
+    Graph directed(3);
+    directed.setEdge(0, 1, 5);
+    EXPECT_THROW(SymmetricGraph::fromGraph(directed), std::invalid_argument);
+}
+
+// Test reachability matrix construction, padding and bit access
+TEST_F(GraphTest, ReachabilityMatrixSetAndGet) {
+    ReachabilityMatrix m(70);
+    EXPECT_EQ(m.size(), 70);
+    EXPECT_EQ(m.wordsPerRow() % ReachabilityMatrix::ROW_ALIGN_WORDS, 0);
+    EXPECT_GE(m.wordsPerRow() * ReachabilityMatrix::BITS_PER_WORD, 70);
+
+    EXPECT_TRUE(m.getEdge(65, 65)); // Every vertex reaches itself
+    EXPECT_FALSE(m.getEdge(0, 65));
+    m.setEdge(0, 65);
+    EXPECT_TRUE(m.getEdge(0, 65));
+    EXPECT_FALSE(m.getEdge(65, 0)); // Directed
+
+    EXPECT_THROW(m.setEdge(70, 0), std::out_of_range);
+    EXPECT_THROW(m.getEdge(0, 70), std::out_of_range);
+    EXPECT_THROW(ReachabilityMatrix(0), std::invalid_argument);
+}
+
+// Test conversion from a weighted graph
+TEST_F(GraphTest, ReachabilityMatrixFromGraph) {
+    Graph g(3);
+    g.setEdge(0, 1, 5);
+    g.setEdge(2, 1, -3);
+
+    ReachabilityMatrix m = ReachabilityMatrix::fromGraph(g);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_EQ(m.getEdge(i, j), g.getEdge(i, j) != Graph::INF);
+        }
+    }
 }
\ No newline at end of file